@@ -3,8 +3,10 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include <limits>
 #include <type_traits>
+#include <utility>
 #include "returns.hpp"
 #include "enable_if.hpp"
+#include "unit.hpp"
 ////////////////////////////////////////////////////////////////////////////////
 namespace arithmetic {
 ////////////////////////////////////////////////////////////////////////////////
@@ -27,10 +29,11 @@ template <class T, class B = void> struct Arithmetic {
   constexpr explicit Arithmetic(const T& other) noexcept(
       std::is_nothrow_constructible<T>::value)
     : value{other} {}
+  /// Scales the value if both B and V are units of the same dimension
   template <class U, class V>
   constexpr explicit Arithmetic(const Arithmetic<U, V>& other) noexcept(
       std::is_nothrow_constructible<T>::value)
-    : value(other.value) {}
+    : value(detail_::unit_cast<V, B>::template apply<T>(other.value)) {}
   constexpr Arithmetic& operator=(const T& other) noexcept {
     value = other;
     return *this;
@@ -44,12 +47,12 @@ template <class T, class B = void> struct Arithmetic {
 
   template <class U, class V>
   explicit constexpr operator Arithmetic<U, V>() noexcept {
-    return value;
+    return Arithmetic<U, V>{*this};
   }
 
   template <class U, class V>
   explicit constexpr operator const Arithmetic<U, V>() const noexcept {
-    return value;
+    return Arithmetic<U, V>{*this};
   }
   ///@}
 
@@ -63,16 +66,36 @@ template <class T, class B = void> struct Arithmetic {
     value -= other.value;
     return *this;
   }
+  template <class V = B, detail_::DisableIf<is_unit<V>> = detail_::dummy>
   constexpr Arithmetic& operator*=(const Arithmetic& other) noexcept {
     value *= other.value;
     return *this;
   }
+  template <class V = B, detail_::DisableIf<is_unit<V>> = detail_::dummy>
   constexpr Arithmetic& operator/=(const Arithmetic& other) noexcept {
     value /= other.value;
     return *this;
   }
   ///@}
 
+  /// \name Compound assignment *=, /= for units
+  ///
+  /// Only dimensionless factors with ratio 1 preserve the unit.
+  ///@{
+  template <class V = B, detail_::EnableIf<is_unit<V>> = detail_::dummy>
+  constexpr Arithmetic& operator*=(
+      const Arithmetic<T, Unit<Dimension<>>>& other) noexcept {
+    value *= other.value;
+    return *this;
+  }
+  template <class V = B, detail_::EnableIf<is_unit<V>> = detail_::dummy>
+  constexpr Arithmetic& operator/=(
+      const Arithmetic<T, Unit<Dimension<>>>& other) noexcept {
+    value /= other.value;
+    return *this;
+  }
+  ///@}
+
   /// \name Prefix increment operators ++(),--()
   ///@{
   constexpr Arithmetic& operator++() noexcept {
@@ -132,12 +155,12 @@ constexpr Arithmetic<T, U> operator-(Arithmetic<T, U> a,
                                      const Arithmetic<T, U>& b) noexcept {
   return a -= b;
 }
-template <class T, class U>
+template <class T, class U, detail_::DisableIf<is_unit<U>> = detail_::dummy>
 constexpr Arithmetic<T, U> operator*(Arithmetic<T, U> a,
                                      const Arithmetic<T, U>& b) noexcept {
   return a *= b;
 }
-template <class T, class U>
+template <class T, class U, detail_::DisableIf<is_unit<U>> = detail_::dummy>
 constexpr Arithmetic<T, U> operator/(Arithmetic<T, U> a,
                                      const Arithmetic<T, U>& b) noexcept {
   return a /= b;
@@ -149,6 +172,28 @@ constexpr Arithmetic<T, U> operator-(Arithmetic<T, U> const& other) noexcept {
 }
 ///@}
 
+/// \name Unit arithmetic operators *,/
+/// \relates Arithmetic<T, U>
+///
+/// The result is tagged with the derived unit. Its ratio is computed at
+/// compile-time, so only the wrapped values are multiplied/divided.
+///@{
+template <class T, class D1, class R1, class D2, class R2>
+constexpr Arithmetic<T, unit_multiply_t<UnitTag<D1, R1>, UnitTag<D2, R2>>>
+    operator*(const Arithmetic<T, UnitTag<D1, R1>>& a,
+              const Arithmetic<T, UnitTag<D2, R2>>& b) noexcept {
+  return Arithmetic<T, unit_multiply_t<UnitTag<D1, R1>, UnitTag<D2, R2>>>{
+      a.value * b.value};
+}
+template <class T, class D1, class R1, class D2, class R2>
+constexpr Arithmetic<T, unit_divide_t<UnitTag<D1, R1>, UnitTag<D2, R2>>>
+    operator/(const Arithmetic<T, UnitTag<D1, R1>>& a,
+              const Arithmetic<T, UnitTag<D2, R2>>& b) noexcept {
+  return Arithmetic<T, unit_divide_t<UnitTag<D1, R1>, UnitTag<D2, R2>>>{
+      a.value / b.value};
+}
+///@}
+
 /// \name Comparison operators ==, !=, <, >, <=, >=
 /// \relates Arithmetic<T, U>
 ///@{
@@ -0,0 +1,289 @@
+#ifndef ARITHMETIC_UTILITIES_ARITHMETIC_TYPE_UNIT_
+#define ARITHMETIC_UTILITIES_ARITHMETIC_TYPE_UNIT_
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+#include "enable_if.hpp"
+////////////////////////////////////////////////////////////////////////////////
+namespace arithmetic {
+////////////////////////////////////////////////////////////////////////////////
+
+/// \name Units
+///@{
+
+template <class B, int N = 1> struct Power;
+
+/// \brief Product of powers of base dimensions, e.g.
+/// Dimension<Power<Length>, Power<Time, -1>> is a velocity
+template <class... Ps> struct Dimension {};
+
+template <class T> struct is_dimension_ : std::false_type {};
+template <class B, int N> struct is_dimension_<Power<B, N>> : std::true_type {};
+template <class... Ps>
+struct is_dimension_<Dimension<Ps...>> : std::true_type {};
+
+/// \brief Base dimension \p B raised to the power \p N
+template <class B, int N> struct Power {
+  static_assert(!is_dimension_<B>::value,
+                "the base of a Power must be a base dimension tag");
+  using base = B;
+  static constexpr int exponent = N;
+};
+
+/// \brief Tag of an Arithmetic type whose values are multiples of \p R in the
+/// dimension \p D
+///
+/// Use the Unit alias instead of naming UnitTag directly.
+template <class D, class R> struct UnitTag {
+  static_assert(R::num > 0, "unit ratios must be positive");
+  using dimension = D;
+  using ratio = R;
+};
+
+/// \brief Key that orders the base dimension \p B within a Dimension<...>
+///
+/// Defaults to B::dimension_key; specialize it for tags that can't have the
+/// member. Only needed for bases that are combined with other bases, and
+/// distinct bases combined with each other must have distinct keys.
+template <class B, class = void> struct dimension_key {
+  static_assert(!std::is_same<B, B>::value,
+                "base dimensions combined with other bases need a "
+                "static constexpr dimension_key member");
+};
+template <class B>
+struct dimension_key<B, decltype(void(B::dimension_key))>
+    : std::integral_constant<std::intmax_t, B::dimension_key> {};
+
+template <class T> struct is_unit : std::false_type {};
+template <class D, class R> struct is_unit<UnitTag<D, R>> : std::true_type {};
+
+///@}
+
+}  // namespace arithmetic
+
+namespace detail_ {
+
+using arithmetic::Power;
+using arithmetic::Dimension;
+using arithmetic::UnitTag;
+
+template <class Q, class D> struct prepend;
+template <class Q, class... Qs> struct prepend<Q, Dimension<Qs...>> {
+  using type = Dimension<Q, Qs...>;
+};
+
+template <class Q, class D>
+using prepend_nonzero
+    = std::conditional_t<Q::exponent == 0, D, typename prepend<Q, D>::type>;
+
+template <class D, class P> struct add_power;
+
+/// Inserts the power \p P into the sorted dimension Dimension<Q, Qs...>
+template <class Q, class D, class P,
+          bool = std::is_same<typename Q::base, typename P::base>::value>
+struct insert_power {
+  using type
+      = prepend_nonzero<Power<typename Q::base, Q::exponent + P::exponent>, D>;
+};
+template <class Q, class D, class P> struct insert_power<Q, D, P, false> {
+  static constexpr std::intmax_t q_key
+      = arithmetic::dimension_key<typename Q::base>::value;
+  static constexpr std::intmax_t p_key
+      = arithmetic::dimension_key<typename P::base>::value;
+  static_assert(q_key != p_key,
+                "distinct base dimensions must have distinct dimension keys");
+  using type = std::conditional_t<
+      (p_key < q_key), typename prepend<P, typename prepend<Q, D>::type>::type,
+      typename prepend<Q, typename add_power<D, P>::type>::type>;
+};
+
+/// Multiplies the dimension \p D, whose powers are sorted by dimension key,
+/// by the power \p P
+template <class P> struct add_power<Dimension<>, P> {
+  using type = prepend_nonzero<P, Dimension<>>;
+};
+template <class Q, class... Qs, class P>
+struct add_power<Dimension<Q, Qs...>, P>
+    : insert_power<Q, Dimension<Qs...>, P> {};
+
+template <class D1, class D2> struct multiply_dimension;
+template <class D1> struct multiply_dimension<D1, Dimension<>> {
+  using type = D1;
+};
+template <class D1, class P, class... Ps>
+struct multiply_dimension<D1, Dimension<P, Ps...>> {
+  using type = typename multiply_dimension<typename add_power<D1, P>::type,
+                                           Dimension<Ps...>>::type;
+};
+
+template <class D> struct invert_dimension;
+template <class... Ps> struct invert_dimension<Dimension<Ps...>> {
+  using type = Dimension<Power<typename Ps::base, -Ps::exponent>...>;
+};
+
+/// Brings a base dimension, a Power<...> or a Dimension<...> into canonical
+/// form: every base appears at most once, no base has exponent zero, and the
+/// powers are sorted by dimension key
+template <class D> struct canonical_dimension {
+  using type = Dimension<Power<D>>;
+};
+template <class B, int N> struct canonical_dimension<Power<B, N>> {
+  using type = prepend_nonzero<Power<B, N>, Dimension<>>;
+};
+template <class... Ps> struct canonical_dimension<Dimension<Ps...>> {
+  using type =
+      typename multiply_dimension<Dimension<>, Dimension<Ps...>>::type;
+};
+
+template <class D1, class D2> using same_dimension = std::is_same<D1, D2>;
+
+template <class U1, class U2> struct unit_multiply {
+  using type = UnitTag<
+      typename multiply_dimension<typename U1::dimension,
+                                  typename U2::dimension>::type,
+      typename std::ratio_multiply<typename U1::ratio,
+                                   typename U2::ratio>::type>;
+};
+
+template <class U1, class U2> struct unit_divide {
+  using type = UnitTag<
+      typename multiply_dimension<
+          typename U1::dimension,
+          typename invert_dimension<typename U2::dimension>::type>::type,
+      typename std::ratio_divide<typename U1::ratio,
+                                 typename U2::ratio>::type>;
+};
+
+template <class C, std::intmax_t N, class = void>
+struct fits : std::true_type {};
+template <class C, std::intmax_t N>
+struct fits<C, N, std::enable_if_t<std::is_integral<C>::value>>
+    : std::integral_constant<bool, static_cast<std::uintmax_t>(N)
+                                   <= static_cast<std::uintmax_t>(
+                                          std::numeric_limits<C>::max())> {};
+
+/// Multiplies \p v by the compile-time ratio \p R. The ratio is reduced, so
+/// the common cases are a no-op, a single multiplication, or a single
+/// division by a constant; the compiler lowers the latter two to shifts
+/// whenever the factor is a power of two.
+///
+/// Only the factor is checked at compile-time: a value whose scaled result
+/// does not fit into \p C still wraps at run-time.
+template <class C, class R, bool = R::num == 1, bool = R::den == 1>
+struct scale {
+  static_assert(fits<C, R::num>::value && fits<C, R::den>::value,
+                "unit conversion factor overflows the value type");
+  static_assert(!std::is_integral<C>::value
+                || static_cast<std::uintmax_t>(R::den - 1)
+                   <= static_cast<std::uintmax_t>(
+                          std::numeric_limits<C>::max()) / R::num,
+                "unit conversion factor overflows the value type");
+  static constexpr C apply(C v) noexcept {
+    return apply(v, std::is_integral<C>{});
+  }
+  /// Divides first, so the result only overflows if it doesn't fit into C
+  static constexpr C apply(C v, std::true_type) noexcept {
+    return v / static_cast<C>(R::den) * static_cast<C>(R::num)
+           + v % static_cast<C>(R::den) * static_cast<C>(R::num)
+             / static_cast<C>(R::den);
+  }
+  static constexpr C apply(C v, std::false_type) noexcept {
+    return v * static_cast<C>(R::num) / static_cast<C>(R::den);
+  }
+};
+template <class C, class R> struct scale<C, R, true, true> {
+  static constexpr C apply(C v) noexcept { return v; }
+};
+template <class C, class R> struct scale<C, R, false, true> {
+  static_assert(fits<C, R::num>::value,
+                "unit conversion factor overflows the value type");
+  static constexpr C apply(C v) noexcept { return v * static_cast<C>(R::num); }
+};
+template <class C, class R> struct scale<C, R, true, false> {
+  static_assert(fits<C, R::den>::value,
+                "unit conversion factor overflows the value type");
+  static constexpr C apply(C v) noexcept { return v / static_cast<C>(R::den); }
+};
+
+/// Type in which a value of type \p U is scaled before it is converted to
+/// \p T. Signed integers are scaled as signed values, so that negative values
+/// are not converted to an unsigned type before they are scaled.
+template <class T, class U,
+          bool = std::is_integral<T>::value && std::is_integral<U>::value
+                 && std::is_signed<U>::value>
+struct scale_type {
+  using type = std::common_type_t<T, U>;
+};
+template <class T, class U> struct scale_type<T, U, true> {
+  using type = std::make_signed_t<std::common_type_t<T, U>>;
+};
+
+template <class B, class = void> struct unit_ratio {
+  using type = std::ratio<1>;
+};
+template <class B>
+struct unit_ratio<B, std::enable_if_t<arithmetic::is_unit<B>::value>> {
+  using type = typename B::ratio;
+};
+
+/// Converts a value with tag \p From into a value with tag \p To. Values are
+/// scaled if both tags are units. Otherwise the raw value is copied, which is
+/// only allowed if the tag that is a unit, if any, has ratio 1.
+template <class From, class To, class = void> struct unit_cast {
+  static_assert(std::ratio_equal<typename unit_ratio<From>::type,
+                                 typename unit_ratio<To>::type>::value,
+                "cannot convert between a scaled unit and a non-unit tag");
+  template <class T, class U> static constexpr T apply(const U& v) noexcept {
+    return T(v);
+  }
+};
+template <class From, class To>
+struct unit_cast<From, To,
+                 std::enable_if_t<arithmetic::is_unit<From>::value
+                                  && arithmetic::is_unit<To>::value>> {
+  static_assert(same_dimension<typename From::dimension,
+                               typename To::dimension>::value,
+                "cannot convert between units of different dimensions");
+  using ratio = typename std::ratio_divide<typename From::ratio,
+                                           typename To::ratio>::type;
+  template <class T, class U> static constexpr T apply(const U& v) noexcept {
+    using C = typename scale_type<T, U>::type;
+    return static_cast<T>(scale<C, ratio>::apply(static_cast<C>(v)));
+  }
+};
+
+}  // namespace detail_
+
+namespace arithmetic {
+
+/// \brief Unit of dimension \p D (a base dimension tag, a Power<...> or a
+/// Dimension<...>) whose values are multiples of the compile-time ratio \p R
+///
+/// Arithmetic types tagged with units of the same dimension convert into each
+/// other via static_cast, scaling the value by a compile-time constant:
+///
+///   struct Time {};
+///   using Nanoseconds = Arithmetic<int64_t, Unit<Time, std::nano>>;
+///   using Microseconds = Arithmetic<int64_t, Unit<Time, std::micro>>;
+///   static_cast<Nanoseconds>(Microseconds{2}) == Nanoseconds{2000};
+///
+/// Multiplying and dividing such types yields the derived unit. Base
+/// dimensions that are combined with each other need a dimension_key.
+template <class D, class R = std::ratio<1>>
+using Unit = UnitTag<typename detail_::canonical_dimension<D>::type,
+                     typename R::type>;
+
+/// \brief Unit of the product of the units \p U1 and \p U2
+template <class U1, class U2>
+using unit_multiply_t = typename detail_::unit_multiply<U1, U2>::type;
+
+/// \brief Unit of the quotient of the units \p U1 and \p U2
+template <class U1, class U2>
+using unit_divide_t = typename detail_::unit_divide<U1, U2>::type;
+
+////////////////////////////////////////////////////////////////////////////////
+}  // namespace arithmetic
+////////////////////////////////////////////////////////////////////////////////
+#endif  // ARITHMETIC_UTILITIES_ARITHMETIC_TYPE_UNIT_
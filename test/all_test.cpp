@@ -10,6 +10,31 @@
 
 using namespace arithmetic;
 
+template <class T, class U, class = void>
+struct is_multiply_assignable : std::false_type {};
+template <class T, class U>
+struct is_multiply_assignable<
+    T, U, decltype(void(std::declval<T&>() *= std::declval<U>()))>
+    : std::true_type {};
+
+template <class T, class U, class = void>
+struct is_divide_assignable : std::false_type {};
+template <class T, class U>
+struct is_divide_assignable<
+    T, U, decltype(void(std::declval<T&>() /= std::declval<U>()))>
+    : std::true_type {};
+
+/// Base dimensions
+struct Time {
+  static constexpr int dimension_key = 0;
+};
+struct Length {
+  static constexpr int dimension_key = 1;
+};
+struct Memory {
+  static constexpr int dimension_key = 2;
+};
+
 template <class T> void test_unsigned_integer_increment_operators() {
   auto i1 = T{1};
   auto i2 = T{2};
@@ -139,6 +164,19 @@ TEST_CASE("Test arithmetic type docs", "[arithmetic_type]") {
     b = static_cast<Type2>(a);  // works: explicit conversion
     Type2 c{a};                 // works: explicit construction
   }
+
+  SECTION("Example 3") {
+    struct Time {};
+    using Nanoseconds = Arithmetic<long, Unit<Time, std::nano>>;
+    using Microseconds = Arithmetic<long, Unit<Time, std::micro>>;
+    Microseconds a{2};
+    Nanoseconds b{3};
+    // b = a; // compilation error: implicit conversion
+    b = static_cast<Nanoseconds>(a);  // works: scales by 1000
+    REQUIRE(b == Nanoseconds{2000});
+    a = Microseconds{b};  // works: scales by 1/1000
+    REQUIRE(a == Microseconds{2});
+  }
 }
 
 TEST_CASE("Test arithmetic type", "[arithmetic_type]") {
@@ -233,6 +271,115 @@ TEST_CASE("Test arithmetic type", "[arithmetic_type]") {
     REQUIRE(b() == 2);
   }
 
+  SECTION("units") {
+    using Nanoseconds = Arithmetic<long, Unit<Time, std::nano>>;
+    using Microseconds = Arithmetic<long, Unit<Time, std::micro>>;
+    using Seconds = Arithmetic<double, Unit<Time>>;
+    using Bytes = Arithmetic<long, Unit<Memory>>;
+    using Pages = Arithmetic<long, Unit<Memory, std::ratio<4096>>>;
+    using BytesPerSecond
+        = Arithmetic<long, Unit<Dimension<Power<Memory>, Power<Time, -1>>>>;
+
+    /// Conversions are scaled at compile-time
+    constexpr auto ns = static_cast<Nanoseconds>(Microseconds{3});
+    static_assert(ns() == 3000, "");
+    constexpr auto us = static_cast<Microseconds>(Nanoseconds{4999});
+    static_assert(us() == 4, "");
+    constexpr auto s = Seconds{Nanoseconds{1500000000}};
+    static_assert(static_cast<long>(s() * 2) == 3, "");
+    REQUIRE(Bytes{Pages{2}} == Bytes{8192});
+    REQUIRE(Pages{Bytes{8192}} == Pages{2});
+    REQUIRE(static_cast<Pages>(Bytes{4095}) == Pages{0});
+
+    /// Non-integer factors don't overflow if the result fits
+    using ThreeHalves = Arithmetic<int, Unit<Time, std::ratio<3, 2>>>;
+    using IntSeconds = Arithmetic<int, Unit<Time>>;
+    REQUIRE(IntSeconds{ThreeHalves{1000000000}} == IntSeconds{1500000000});
+    REQUIRE(IntSeconds{ThreeHalves{-3}} == IntSeconds{-4});
+    REQUIRE(ThreeHalves{IntSeconds{2000000000}} == ThreeHalves{1333333333});
+
+    /// Signed values are scaled before they are converted to unsigned
+    using UnsignedMicroseconds = Arithmetic<unsigned, Unit<Time, std::micro>>;
+    using IntNanoseconds = Arithmetic<int, Unit<Time, std::nano>>;
+    REQUIRE(UnsignedMicroseconds{IntNanoseconds{-3000}}
+            == UnsignedMicroseconds{static_cast<unsigned>(-3)});
+    REQUIRE(UnsignedMicroseconds{IntNanoseconds{3000}}
+            == UnsignedMicroseconds{3u});
+
+    /// Equal units with differently spelled ratios are the same type
+    using Pages2 = Arithmetic<long, Unit<Memory, std::ratio<8192, 2>>>;
+    static_assert(std::is_same<Pages, Pages2>::value, "");
+
+    /// Units of different dimensions are not implicitly convertible
+    static_assert(!std::is_convertible<Bytes, Nanoseconds>::value, "");
+    static_assert(!std::is_convertible<Pages, Bytes>::value, "");
+
+    /// Multiplication and division derive the unit
+    auto area = Nanoseconds{2} * Microseconds{3};
+    using Area = Arithmetic<long, Unit<Dimension<Power<Time, 2>>,
+                                       std::ratio<1, 1000000000000000>>>;
+    static_assert(std::is_same<decltype(area), Area>::value, "");
+    REQUIRE(area() == 6);
+    auto t = area / Microseconds{3};
+    static_assert(std::is_same<decltype(t), Nanoseconds>::value, "");
+    REQUIRE(t == Nanoseconds{2});
+
+    auto ratio = Nanoseconds{4000} / Microseconds{2};
+    using Milli = Arithmetic<long, Unit<Dimension<>, std::milli>>;
+    static_assert(std::is_same<decltype(ratio), Milli>::value, "");
+    REQUIRE(ratio() == 2000);
+    REQUIRE(static_cast<Arithmetic<long, Unit<Dimension<>>>>(ratio)() == 2);
+
+    /// Units with ratio 1 convert to and from non-unit tags
+    REQUIRE(Arithmetic<long>{Arithmetic<long, Unit<Time>>{3}}
+            == Arithmetic<long>{3});
+    REQUIRE(Arithmetic<long, Unit<Time>>{Arithmetic<long>{3}}
+            == Arithmetic<long, Unit<Time>>{3});
+
+    /// Compound multiplication and division only accept dimensionless
+    /// factors with ratio 1, which preserve the unit
+    using Scalar = Arithmetic<long, Unit<Dimension<>>>;
+    static_assert(!is_multiply_assignable<Nanoseconds, Nanoseconds>::value, "");
+    static_assert(!is_divide_assignable<Nanoseconds, Nanoseconds>::value, "");
+    static_assert(!is_multiply_assignable<Nanoseconds, Milli>::value, "");
+    static_assert(is_multiply_assignable<Nanoseconds, Scalar>::value, "");
+    static_assert(is_divide_assignable<Nanoseconds, Scalar>::value, "");
+    static_assert(
+        is_multiply_assignable<Arithmetic<long>, Arithmetic<long>>::value, "");
+    auto d = Nanoseconds{2};
+    d *= Scalar{6};
+    d /= Scalar{4};
+    REQUIRE(d == Nanoseconds{3});
+
+    /// The derived unit does not depend on the order of the operands
+    using Meters = Arithmetic<long, Unit<Length>>;
+    using Hertz = Arithmetic<long, Unit<Power<Time, -1>>>;
+    auto mhz = Meters{2} * Hertz{3};
+    auto hzm = Hertz{3} * Meters{2};
+    static_assert(std::is_same<decltype(mhz), decltype(hzm)>::value, "");
+    REQUIRE(mhz == hzm);
+    static_assert(std::is_same<Unit<Power<Time, -1>>,
+                               Unit<Dimension<Power<Time, -1>>>>::value,
+                  "");
+    static_assert(std::is_same<Unit<Power<Time, 0>>, Unit<Dimension<>>>::value,
+                  "");
+    static_assert(
+        std::is_same<Unit<Dimension<Power<Length>, Power<Time, -1>>>,
+                     Unit<Dimension<Power<Time, -1>, Power<Length>>>>::value,
+        "");
+
+    auto bw = Pages{4} / Arithmetic<long, Unit<Time>>{2};
+    REQUIRE(static_cast<BytesPerSecond>(bw) == BytesPerSecond{8192});
+    using SecondsPerByte
+        = Arithmetic<long, Unit<Dimension<Power<Time>, Power<Memory, -1>>>>;
+    static_assert(std::is_same<decltype(Bytes{} / BytesPerSecond{}),
+                               Arithmetic<long, Unit<Time>>>::value,
+                  "");
+    static_assert(std::is_same<decltype(Bytes{} * SecondsPerByte{}),
+                               Arithmetic<long, Unit<Time>>>::value,
+                  "");
+  }
+
   SECTION("pointer arithmetic") {
     int a[5] = {0, 1, 2, 3, 4};
     int* ap = &a[0];